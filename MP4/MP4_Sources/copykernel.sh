@@ -1,5 +1,7 @@
 # Replace "/mnt/floppy" with the whatever directory is appropriate.
 sudo mount -o loop dev_kernel_grub.img /mnt/floppy
 sudo cp kernel.bin /mnt/floppy
+# The RAM disk image, if there is one (see ramdisk.H).
+[ -f ramdisk.img ] && sudo cp ramdisk.img /mnt/floppy
 sleep 1s
 sudo umount /mnt/floppy
@@ -0,0 +1,122 @@
+#!/usr/bin/env python3
+#
+# File: framemap.py
+#
+# Description: Renders the frame maps that ContFramePool::dump_map writes
+# to port E9, see cont_frame_pool.H.
+#
+#   python3 framemap.py [-w <columns>] [--pgm <prefix>] <capture>
+#
+# <capture> is everything the kernel wrote to port E9, e.g. from QEMU with
+# "-debugcon file:e9.log", or the log of bochs with port_e9_hack enabled.
+# Console text around the records is skipped. For each record, the tool
+# prints the fragmentation summary of the pool and a heat map with one
+# character per cell of frames, darker for more frames in use. With
+# --pgm, it also writes <prefix>N.pgm, one pixel per frame.
+
+import argparse
+import struct
+import sys
+
+MAGIC = b"FRAMEMAP"
+HEADER = struct.Struct("<III")      # version, first frame, number of frames
+VERSION = 1
+FREE, USED, HEAD = 0, 1, 2
+SHADES = " .:-=+*#%@"               # from all free to all used
+PGM_WIDTH = 128
+
+
+def parse(data):
+    """Yields (first frame, frame states) for every record in the capture."""
+    pos = data.find(MAGIC)
+    while pos >= 0:
+        start = pos + len(MAGIC)
+        if start + HEADER.size > len(data):
+            break
+        version, first, n_frames = HEADER.unpack_from(data, start)
+        body = start + HEADER.size
+        n_bytes = (n_frames + 3) // 4
+        if version != VERSION or body + n_bytes > len(data):
+            pos = data.find(MAGIC, start)
+            continue
+        states = [(data[body + i // 4] >> (2 * (i % 4))) & 3 for i in range(n_frames)]
+        yield first, states
+        pos = data.find(MAGIC, body + n_bytes)
+
+
+def free_runs(states):
+    runs = []
+    length = 0
+    for s in states + [USED]:
+        if s == FREE:
+            length += 1
+        elif length > 0:
+            runs.append(length)
+            length = 0
+    return runs
+
+
+def summary(first, states):
+    runs = free_runs(states)
+    n_free = sum(runs)
+    largest = max(runs) if runs else 0
+    index = 100 - largest * 100 // n_free if n_free else 0
+    n_sequences = states.count(HEAD)
+    print("frames %d ... %d: %d free in %d runs, largest run %d, "
+          "%d sequences, fragmentation index %d%%"
+          % (first, first + len(states) - 1, n_free, len(runs), largest,
+             n_sequences, index))
+    classes = {}
+    for r in runs:
+        c = r.bit_length() - 1
+        classes[c] = classes.get(c, 0) + 1
+    for c in sorted(classes):
+        print("  runs of %6d-%-6d frames: %d" % (1 << c, (2 << c) - 1, classes[c]))
+
+
+def heat_map(first, states, columns):
+    rows = 32
+    cell = max(1, -(-len(states) // (columns * rows)))
+    print("one cell = %d frame(s)" % cell)
+    for row_start in range(0, len(states), cell * columns):
+        line = []
+        for c in range(row_start, min(row_start + cell * columns, len(states)), cell):
+            chunk = states[c:c + cell]
+            used = sum(1 for s in chunk if s != FREE)
+            line.append(SHADES[used * (len(SHADES) - 1) // len(chunk)])
+        print("%8d |%s|" % (first + row_start, "".join(line)))
+
+
+def write_pgm(path, states):
+    height = -(-len(states) // PGM_WIDTH)
+    pixels = bytearray(255 for _ in range(PGM_WIDTH * height))
+    for i, s in enumerate(states):
+        pixels[i] = 255 if s == FREE else (0 if s == HEAD else 96)
+    with open(path, "wb") as f:
+        f.write(b"P5\n%d %d\n255\n" % (PGM_WIDTH, height))
+        f.write(pixels)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Render frame maps dumped to port E9.")
+    parser.add_argument("capture")
+    parser.add_argument("-w", "--columns", type=int, default=64)
+    parser.add_argument("--pgm", metavar="PREFIX")
+    args = parser.parse_args()
+
+    with open(args.capture, "rb") as f:
+        data = f.read()
+    n = 0
+    for first, states in parse(data):
+        print("== frame map %d" % n)
+        summary(first, states)
+        heat_map(first, states, args.columns)
+        if args.pgm:
+            write_pgm("%s%d.pgm" % (args.pgm, n), states)
+        n += 1
+    if n == 0:
+        sys.exit("no frame maps in %s" % args.capture)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,58 @@
+#!/usr/bin/env python3
+#
+# File: mkramdisk.py
+#
+# Description: Builds a RAM disk image for the kernel, see ramdisk.H.
+#
+#   python3 mkramdisk.py <image> <file> [<file> ...]
+#
+# The image starts with a header and a directory of the files, and is
+# followed by the contents of each file, page aligned and padded with
+# zeros to a whole page. Files are named by their base name.
+
+import os
+import struct
+import sys
+
+PAGE_SIZE = 4096
+RAMDISK_MAGIC = 0x4B534452          # "RDSK"
+RAMDISK_NAME_LENGTH = 56
+RAMDISK_MAX_FILES = 64
+HEADER = struct.Struct("<II")       # magic, n_files
+ENTRY = struct.Struct("<%dsII" % RAMDISK_NAME_LENGTH)  # name, offset, size
+
+
+def page_align(n):
+    return (n + PAGE_SIZE - 1) // PAGE_SIZE * PAGE_SIZE
+
+
+def main(argv):
+    if len(argv) < 3:
+        sys.exit("usage: %s <image> <file> [<file> ...]" % argv[0])
+    files = argv[2:]
+    if len(files) > RAMDISK_MAX_FILES:
+        sys.exit("at most %d files" % RAMDISK_MAX_FILES)
+
+    offset = page_align(HEADER.size + ENTRY.size * len(files))
+    directory = []
+    for path in files:
+        name = os.path.basename(path).encode()
+        if len(name) >= RAMDISK_NAME_LENGTH:
+            sys.exit("name too long: %s" % path)
+        size = os.path.getsize(path)
+        directory.append((path, name, offset, size))
+        offset += page_align(size)
+
+    with open(argv[1], "wb") as image:
+        image.write(HEADER.pack(RAMDISK_MAGIC, len(files)))
+        for _, name, offset, size in directory:
+            image.write(ENTRY.pack(name, offset, size))
+        for path, _, offset, size in directory:
+            image.write(b"\0" * (offset - image.tell()))
+            with open(path, "rb") as f:
+                image.write(f.read())
+        image.write(b"\0" * (page_align(image.tell()) - image.tell()))
+
+
+if __name__ == "__main__":
+    main(sys.argv)
@@ -12,6 +12,8 @@
 global start
 start:
     mov esp, _sys_stack     ; This points the stack to our new stack area
+    mov [_multiboot_magic], eax ; The boot loader passes its magic number in eax
+    mov [_multiboot_info], ebx  ; and the physical address of its info structure in ebx
     jmp stublet
 
 ; This part MUST be 4byte aligned, so we solve that issue using 'ALIGN 4'
@@ -24,6 +26,8 @@ mboot:
     MULTIBOOT_HEADER_MAGIC	equ 0x1BADB002
     MULTIBOOT_HEADER_FLAGS	equ MULTIBOOT_PAGE_ALIGN | MULTIBOOT_MEMORY_INFO | MULTIBOOT_AOUT_KLUDGE
     MULTIBOOT_CHECKSUM	equ -(MULTIBOOT_HEADER_MAGIC + MULTIBOOT_HEADER_FLAGS)
+    MODULES_START	equ 0x400000 ; the boot loader puts modules after the bss,
+				; i.e. in the process pool, see ramdisk.H
     EXTERN code, bss, end
 
     ; This is the GRUB Multiboot header. A boot signature
@@ -40,10 +44,13 @@ mboot:
     dd bss			; load_end_addr:
 				; physical address of the end of the data segment
 				; (load_end_addr - load_addr) specifies how much data to load.
-    dd end			; bss_end_addr:
+    dd MODULES_START		; bss_end_addr:
 				; pysical address of end of bss segment.
 				; boot loader initializes this area to zero,
-				; and reserves the memory
+				; and reserves the memory. We claim everything
+				; up to the process pool (the kernel pool is
+				; initialized later anyway), so that modules
+				; are loaded above it.
     dd start			; entry_addr:
 				; physical address to which the boot loader should jump
 				; to start running the OS
@@ -108,3 +115,11 @@ SECTION .bss
     resb 8192               ; This reserves 8KBytes of memory here
 _sys_stack:
 
+; Where the boot loader left its information, see ramdisk.H
+global _multiboot_magic
+global _multiboot_info
+_multiboot_magic:
+    resd 1
+_multiboot_info:
+    resd 1
+
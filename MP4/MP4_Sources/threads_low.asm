@@ -0,0 +1,28 @@
+; File: threads_low.asm
+;
+; Low-level context switch for kernel threads. See threads_low.H.
+
+; ----------------------------------------------------------------------
+; threads_low_switch_to(unsigned long * _save_esp, unsigned long _new_esp)
+;
+; The frame saved on the stack, from the saved stack pointer up:
+;   EFLAGS, EDI, ESI, EBX, EBP, return address.
+; Thread::Thread builds the same frame for a new thread.
+; ----------------------------------------------------------------------
+global _threads_low_switch_to
+_threads_low_switch_to:
+	mov	eax, [esp+4]	; _save_esp
+	mov	edx, [esp+8]	; _new_esp
+	push	ebp
+	push	ebx
+	push	esi
+	push	edi
+	pushfd
+	mov	[eax], esp	; save the old thread's stack pointer
+	mov	esp, edx	; and continue on the new thread's stack
+	popfd
+	pop	edi
+	pop	esi
+	pop	ebx
+	pop	ebp
+	ret